@@ -27,9 +27,12 @@ typedef enum {
     EEPROM_24C32_ERR_WRITE_TIMEOUT,     /**< Write operation timed out */
 } eeprom_24c32_result_t;
 
+struct eeprom_24c32_trace;
+
 typedef struct {
     struct nhal_i2c_context *ctx;        /**< nhal I2C context */
     nhal_i2c_address_t device_address;   /**< I2C device address */
+    struct eeprom_24c32_trace *trace;    /**< Optional bus tracer, NULL when disabled (see eeprom_24c32_trace.h) */
 } eeprom_24c32_handle_t;
 
 /**
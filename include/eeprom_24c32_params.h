@@ -0,0 +1,237 @@
+/**
+ * @file eeprom_24c32_params.h
+ * @brief Schema-driven persistent parameter region on top of the 24C32 driver
+ *
+ * A parameter set is described once as an X-macro list. The layout is fixed
+ * at compile time and follows the list order. FIELD entries use the natural
+ * alignment of their type and pack tightly, but may straddle a page, which
+ * costs one extra page write when such a field changes. FIELD_HOT entries
+ * are aligned to the next power of two of their size (capped at the page
+ * size), so within a page-aligned region a hot field of up to 32 bytes
+ * never straddles a page boundary. The price is padding: a 17-byte hot
+ * field occupies a 32-byte slot, so reserve FIELD_HOT for frequently saved
+ * fields.
+ *
+ * The generated code keeps a RAM shadow of the whole region plus per-page
+ * dirty ranges:
+ *
+ * - name_load() fills the shadow with a single sequential read
+ * - name_get_<field>() reads from the shadow without bus traffic
+ * - name_set_<field>() updates the shadow and marks the touched bytes dirty
+ *   (writing an unchanged value is a no-op)
+ * - name_save() issues at most one page write per page holding dirty bytes
+ *
+ * Because a page write covers the whole span between the first and last
+ * dirty byte of a page, saving is refused until name_load() has succeeded
+ * once, so untouched fields in that span are never overwritten with
+ * unloaded data.
+ *
+ * Example:
+ * @code
+ * #define APP_PARAMS(FIELD, FIELD_HOT, set)     \
+ *     FIELD_HOT(set, uint32_t, boot_count)      \
+ *     FIELD(set, float,    gain)                \
+ *     FIELD(set, app_calibration_t, calib)
+ *
+ * EEPROM_24C32_PARAMS_DECLARE(app_params, APP_PARAMS)
+ *
+ * static app_params_t params;
+ * app_params_init(&params, &eeprom, 0x0100);
+ * app_params_load(&params);
+ * app_params_set_boot_count(&params, app_params_get_boot_count(&params) + 1);
+ * app_params_save(&params);
+ * @endcode
+ *
+ * The stored image uses the in-memory representation of each field type
+ * (endianness, floating point format), so it is only portable between
+ * targets sharing that ABI.
+ *
+ * Restrictions:
+ * - Field types must not contain padding bytes. Setters compare and store
+ *   the raw bytes of the value, so indeterminate padding would mark fields
+ *   dirty for no reason and end up in the EEPROM.
+ * - name_t holds pointers into itself. It must not be copied or assigned,
+ *   and must live in static or automatic storage: hot fields can raise its
+ *   alignment up to 32 bytes, which heap allocation (malloc, C++14 new)
+ *   does not guarantee.
+ */
+#ifndef EEPROM_24C32_PARAMS_H
+#define EEPROM_24C32_PARAMS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "eeprom_24c32.h"
+
+#ifdef __cplusplus
+#define EEPROM_24C32_PARAMS_ALIGNAS(n) alignas(n)
+#else
+#define EEPROM_24C32_PARAMS_ALIGNAS(n) _Alignas(n)
+#endif
+
+/** Smallest power of two >= size, capped at the page size */
+#define EEPROM_24C32_PARAMS_FIELD_ALIGN(size) \
+    ((size) <= 1 ? 1 : (size) <= 2 ? 2 : (size) <= 4 ? 4 : \
+     (size) <= 8 ? 8 : (size) <= 16 ? 16 : EEPROM_24C32_PAGE_SIZE_BYTES)
+
+/** Number of pages spanned by a page-aligned region of the given size */
+#define EEPROM_24C32_PARAMS_PAGE_COUNT(size) \
+    (((size) + EEPROM_24C32_PAGE_SIZE_BYTES - 1) / EEPROM_24C32_PAGE_SIZE_BYTES)
+
+typedef struct {
+    uint8_t first;                      /**< First dirty byte within the page */
+    uint8_t last;                       /**< Last dirty byte within the page, clean if first > last */
+} eeprom_24c32_params_dirty_t;
+
+typedef struct {
+    eeprom_24c32_handle_t *eeprom;      /**< Initialized EEPROM handle */
+    uint16_t base_address;              /**< Page-aligned start of the region in EEPROM */
+    uint16_t size;                      /**< Region size in bytes */
+    uint8_t *shadow;                    /**< RAM copy of the region */
+    eeprom_24c32_params_dirty_t *dirty; /**< One dirty range per page */
+    bool loaded;                        /**< Set by a successful eeprom_24c32_params_load() */
+} eeprom_24c32_params_t;
+
+/**
+ * @brief Initialize a parameter region
+ *
+ * Usually called through the generated name_init() function. The shadow is
+ * zeroed and the region starts out unloaded.
+ *
+ * @param params Pointer to parameter region structure
+ * @param eeprom Pointer to initialized EEPROM handle
+ * @param base_address Page-aligned start address of the region
+ * @param shadow RAM copy of the region (size bytes)
+ * @param size Region size in bytes
+ * @param dirty Dirty range storage
+ * @param dirty_count Number of entries in dirty (at least one per page)
+ * @return eeprom_24c32_result_t Result of initialization
+ */
+eeprom_24c32_result_t eeprom_24c32_params_init(
+    eeprom_24c32_params_t *params,
+    eeprom_24c32_handle_t *eeprom,
+    uint16_t base_address,
+    void *shadow,
+    size_t size,
+    eeprom_24c32_params_dirty_t *dirty,
+    size_t dirty_count
+);
+
+/**
+ * @brief Load the whole region into the shadow with one sequential read
+ *
+ * All dirty ranges are cleared whether or not the read succeeds, so changes
+ * made before the load are discarded. On failure the shadow content is
+ * undefined and the region is marked unloaded, which makes
+ * eeprom_24c32_params_save() refuse to write until a later load succeeds.
+ *
+ * @param params Pointer to initialized parameter region
+ * @return eeprom_24c32_result_t Result of read operation
+ */
+eeprom_24c32_result_t eeprom_24c32_params_load(eeprom_24c32_params_t *params);
+
+/**
+ * @brief Update bytes in the shadow and mark them dirty
+ *
+ * Bytes are only marked dirty when their value actually changes.
+ *
+ * @param params Pointer to initialized parameter region
+ * @param offset Offset within the region
+ * @param data New value
+ * @param length Number of bytes
+ * @return eeprom_24c32_result_t Result of operation
+ */
+eeprom_24c32_result_t eeprom_24c32_params_set(
+    eeprom_24c32_params_t *params,
+    size_t offset,
+    const void *data,
+    size_t length
+);
+
+/**
+ * @brief Write all dirty bytes back to the EEPROM
+ *
+ * Issues one page write per page holding dirty bytes, covering only the
+ * span between its first and last dirty byte. Pages are marked clean as
+ * they are written, so a failed save can be retried.
+ *
+ * @param params Pointer to initialized parameter region
+ * @return eeprom_24c32_result_t EEPROM_24C32_ERR_INVALID_ARG if the region
+ *         has not been loaded successfully, otherwise result of write operations
+ */
+eeprom_24c32_result_t eeprom_24c32_params_save(eeprom_24c32_params_t *params);
+
+/**
+ * @brief Check whether the shadow holds unsaved changes
+ *
+ * @param params Pointer to initialized parameter region
+ * @return true if at least one page is dirty
+ */
+bool eeprom_24c32_params_is_dirty(const eeprom_24c32_params_t *params);
+
+#define EEPROM_24C32_PARAMS_MEMBER_(set, type, field) \
+    type field;
+
+#define EEPROM_24C32_PARAMS_MEMBER_HOT_(set, type, field) \
+    EEPROM_24C32_PARAMS_ALIGNAS(EEPROM_24C32_PARAMS_FIELD_ALIGN(sizeof(type))) type field;
+
+#define EEPROM_24C32_PARAMS_ACCESSORS_(set, type, field)                              \
+    static inline type set##_get_##field(const set##_t *p)                            \
+    {                                                                                  \
+        return p->image.field;                                                         \
+    }                                                                                  \
+    static inline eeprom_24c32_result_t set##_set_##field(set##_t *p, type value)     \
+    {                                                                                  \
+        return eeprom_24c32_params_set(&p->region, offsetof(set##_image_t, field),    \
+                                       &value, sizeof(value));                         \
+    }
+
+/**
+ * @brief Generate the layout, storage type and accessors of a parameter set
+ *
+ * FIELDS is an X-macro taking (FIELD, FIELD_HOT, set) and expanding
+ * FIELD(set, type, field) or FIELD_HOT(set, type, field) once per
+ * parameter. Generates:
+ * name_image_t, name_t, name_init(), name_load(), name_save() and
+ * name_get_<field>() / name_set_<field>() for every field.
+ */
+#define EEPROM_24C32_PARAMS_DECLARE(name, FIELDS)                                      \
+    typedef struct {                                                                   \
+        FIELDS(EEPROM_24C32_PARAMS_MEMBER_, EEPROM_24C32_PARAMS_MEMBER_HOT_, name)     \
+    } name##_image_t;                                                                  \
+                                                                                       \
+    typedef char name##_fits_in_eeprom_[                                               \
+        (sizeof(name##_image_t) <= EEPROM_24C32_SIZE_BYTES) ? 1 : -1];                 \
+                                                                                       \
+    typedef struct {                                                                   \
+        eeprom_24c32_params_t region;                                                  \
+        name##_image_t image;                                                          \
+        eeprom_24c32_params_dirty_t dirty[                                             \
+            EEPROM_24C32_PARAMS_PAGE_COUNT(sizeof(name##_image_t))];                   \
+    } name##_t;                                                                        \
+                                                                                       \
+    static inline eeprom_24c32_result_t name##_init(                                   \
+        name##_t *p, eeprom_24c32_handle_t *eeprom, uint16_t base_address)             \
+    {                                                                                  \
+        if (p == NULL) {                                                               \
+            return EEPROM_24C32_ERR_INVALID_ARG;                                       \
+        }                                                                              \
+        return eeprom_24c32_params_init(&p->region, eeprom, base_address,             \
+                                        &p->image, sizeof(p->image),                   \
+                                        p->dirty, sizeof(p->dirty) / sizeof(p->dirty[0])); \
+    }                                                                                  \
+                                                                                       \
+    static inline eeprom_24c32_result_t name##_load(name##_t *p)                       \
+    {                                                                                  \
+        return eeprom_24c32_params_load(&p->region);                                   \
+    }                                                                                  \
+                                                                                       \
+    static inline eeprom_24c32_result_t name##_save(name##_t *p)                       \
+    {                                                                                  \
+        return eeprom_24c32_params_save(&p->region);                                   \
+    }                                                                                  \
+                                                                                       \
+    FIELDS(EEPROM_24C32_PARAMS_ACCESSORS_, EEPROM_24C32_PARAMS_ACCESSORS_, name)
+
+#endif /* EEPROM_24C32_PARAMS_H */
@@ -0,0 +1,206 @@
+/**
+ * @file eeprom_24c32_trace.h
+ * @brief Optional bus-transaction tracer for the 24C32 EEPROM driver
+ *
+ * The tracer records every nhal I2C master call issued by the driver into
+ * a fixed-size ring buffer supplied by the caller. It is attached to a
+ * handle at runtime; a handle without a tracer pays a single pointer check
+ * per bus transaction, so the tracer can stay compiled into production
+ * builds.
+ *
+ * Recorded transactions can be exported as CSV or Chrome trace JSON
+ * (chrome://tracing, Perfetto) with the functions at the end of this file.
+ */
+#ifndef EEPROM_24C32_TRACE_H
+#define EEPROM_24C32_TRACE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "nhal_common.h"
+#include "eeprom_24c32.h"
+
+typedef enum {
+    EEPROM_24C32_TRACE_OP_READ = 0,     /**< Address phase followed by data read */
+    EEPROM_24C32_TRACE_OP_WRITE_PAGE,   /**< Address phase followed by page data write */
+    EEPROM_24C32_TRACE_OP_READY_PROBE,  /**< Acknowledge poll issued by eeprom_24c32_is_ready() */
+} eeprom_24c32_trace_op_t;
+
+/**
+ * @brief Clock used to timestamp trace records
+ *
+ * @param clock_ctx User context passed to eeprom_24c32_trace_init()
+ * @return Free-running timestamp in microseconds (wrap-around is allowed)
+ */
+typedef uint32_t (*eeprom_24c32_trace_clock_t)(void *clock_ctx);
+
+/**
+ * @brief Output sink used by the exporters
+ *
+ * @param sink_ctx User context passed to the exporter
+ * @param text Chunk of exported text (not NUL-terminated)
+ * @param length Number of bytes in text
+ */
+typedef void (*eeprom_24c32_trace_sink_t)(void *sink_ctx, const char *text, size_t length);
+
+typedef struct {
+    uint32_t timestamp_us;              /**< Clock value when the transaction started */
+    uint32_t duration_us;               /**< Time spent inside the nhal call */
+    uint16_t address;                   /**< EEPROM memory address (0 for ready probes) */
+    uint16_t length;                    /**< Payload length in bytes, excluding address bytes */
+    uint8_t op;                         /**< One of eeprom_24c32_trace_op_t */
+    uint8_t result;                     /**< nhal_result_t returned by the nhal call */
+} eeprom_24c32_trace_record_t;
+
+typedef struct eeprom_24c32_trace {
+    eeprom_24c32_trace_record_t *records; /**< Caller-provided ring buffer storage */
+    size_t capacity;                    /**< Number of entries in records */
+    size_t head;                        /**< Index of the next slot to be written */
+    size_t count;                       /**< Number of valid records in the buffer */
+    uint32_t dropped;                   /**< Records overwritten since the last reset */
+    eeprom_24c32_trace_clock_t clock;   /**< Timestamp source */
+    void *clock_ctx;                    /**< User context for clock */
+} eeprom_24c32_trace_t;
+
+/**
+ * @brief Initialize a tracer over caller-provided storage
+ *
+ * @param trace Pointer to tracer structure
+ * @param records Ring buffer storage
+ * @param capacity Number of records that fit in storage (must be > 0)
+ * @param clock Timestamp source in microseconds
+ * @param clock_ctx User context forwarded to clock (may be NULL)
+ * @return eeprom_24c32_result_t Result of initialization
+ */
+eeprom_24c32_result_t eeprom_24c32_trace_init(
+    eeprom_24c32_trace_t *trace,
+    eeprom_24c32_trace_record_t *records,
+    size_t capacity,
+    eeprom_24c32_trace_clock_t clock,
+    void *clock_ctx
+);
+
+/**
+ * @brief Attach a tracer to an EEPROM handle
+ *
+ * Passing NULL as trace detaches the current tracer and disables tracing.
+ *
+ * @param handle Pointer to initialized EEPROM handle
+ * @param trace Initialized tracer, or NULL to disable tracing
+ * @return eeprom_24c32_result_t Result of operation
+ */
+eeprom_24c32_result_t eeprom_24c32_trace_attach(
+    eeprom_24c32_handle_t *handle,
+    eeprom_24c32_trace_t *trace
+);
+
+/**
+ * @brief Discard all recorded transactions
+ *
+ * @param trace Pointer to initialized tracer
+ */
+void eeprom_24c32_trace_reset(eeprom_24c32_trace_t *trace);
+
+/**
+ * @brief Append a record to the ring buffer
+ *
+ * Called by the driver after each nhal I2C master call. When the buffer is
+ * full the oldest record is overwritten and the dropped counter increases.
+ * Defined inline so that src/eeprom_24c32.c links without the tracer
+ * sources; only applications that initialize a tracer need
+ * src/eeprom_24c32_trace.c.
+ *
+ * @param trace Pointer to initialized tracer
+ * @param op Transaction type
+ * @param address EEPROM memory address
+ * @param length Payload length in bytes
+ * @param result Result returned by the nhal call
+ * @param start_us Clock value sampled before the nhal call
+ */
+static inline void eeprom_24c32_trace_record(
+    eeprom_24c32_trace_t *trace,
+    eeprom_24c32_trace_op_t op,
+    uint16_t address,
+    size_t length,
+    nhal_result_t result,
+    uint32_t start_us)
+{
+    if (trace == NULL) {
+        return;
+    }
+
+    uint32_t end_us = trace->clock(trace->clock_ctx);
+
+    eeprom_24c32_trace_record_t *record = &trace->records[trace->head];
+    record->timestamp_us = start_us;
+    record->duration_us = end_us - start_us;
+    record->address = address;
+    record->length = (uint16_t)length;
+    record->op = (uint8_t)op;
+    record->result = (uint8_t)result;
+
+    trace->head = (trace->head + 1) % trace->capacity;
+    if (trace->count < trace->capacity) {
+        trace->count++;
+    } else {
+        trace->dropped++;
+    }
+}
+
+/**
+ * @brief Get a recorded transaction, oldest first
+ *
+ * @param trace Pointer to initialized tracer
+ * @param index Position from the oldest record (0 to count - 1)
+ * @param record Output record
+ * @return eeprom_24c32_result_t EEPROM_24C32_ERR_INVALID_ARG if index is out of range
+ */
+eeprom_24c32_result_t eeprom_24c32_trace_get(
+    const eeprom_24c32_trace_t *trace,
+    size_t index,
+    eeprom_24c32_trace_record_t *record
+);
+
+/**
+ * @brief Get the name of a transaction type
+ *
+ * @param op Transaction type
+ * @return Static lowercase name, "unknown" for invalid values
+ */
+const char *eeprom_24c32_trace_op_name(eeprom_24c32_trace_op_t op);
+
+/**
+ * @brief Export recorded transactions as CSV
+ *
+ * Emits a header line followed by one line per record, oldest first:
+ * timestamp_us,duration_us,op,address,length,result
+ *
+ * @param trace Pointer to initialized tracer
+ * @param sink Output sink
+ * @param sink_ctx User context forwarded to sink
+ * @return eeprom_24c32_result_t Result of export
+ */
+eeprom_24c32_result_t eeprom_24c32_trace_export_csv(
+    const eeprom_24c32_trace_t *trace,
+    eeprom_24c32_trace_sink_t sink,
+    void *sink_ctx
+);
+
+/**
+ * @brief Export recorded transactions as Chrome trace event JSON
+ *
+ * Each record becomes a complete ("X") event that can be loaded into
+ * chrome://tracing or Perfetto.
+ *
+ * @param trace Pointer to initialized tracer
+ * @param sink Output sink
+ * @param sink_ctx User context forwarded to sink
+ * @return eeprom_24c32_result_t Result of export
+ */
+eeprom_24c32_result_t eeprom_24c32_trace_export_chrome_json(
+    const eeprom_24c32_trace_t *trace,
+    eeprom_24c32_trace_sink_t sink,
+    void *sink_ctx
+);
+
+#endif /* EEPROM_24C32_TRACE_H */
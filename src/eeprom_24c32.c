@@ -4,9 +4,31 @@
  */
 
 #include "eeprom_24c32.h"
+#include "eeprom_24c32_trace.h"
 #include "nhal_common.h"
 #include <string.h>
 
+static inline uint32_t trace_begin(const eeprom_24c32_handle_t *handle)
+{
+    if (handle->trace == NULL) {
+        return 0;
+    }
+    return handle->trace->clock(handle->trace->clock_ctx);
+}
+
+static inline void trace_end(
+    const eeprom_24c32_handle_t *handle,
+    eeprom_24c32_trace_op_t op,
+    uint16_t address,
+    size_t length,
+    nhal_result_t result,
+    uint32_t start_us)
+{
+    if (handle->trace != NULL) {
+        eeprom_24c32_trace_record(handle->trace, op, address, length, result, start_us);
+    }
+}
+
 static eeprom_24c32_result_t hal_to_eeprom_result(nhal_result_t hal_result)
 {
     switch (hal_result) {
@@ -45,6 +67,7 @@ eeprom_24c32_result_t eeprom_24c32_init(
     handle->ctx = ctx;
     handle->device_address.type = NHAL_I2C_7BIT_ADDR;
     handle->device_address.addr.address_7bit = device_address;
+    handle->trace = NULL;
 
     return EEPROM_24C32_OK;
 }
@@ -69,6 +92,7 @@ eeprom_24c32_result_t eeprom_24c32_read(
         (uint8_t)(address & 0xFF)
     };
 
+    uint32_t trace_start = trace_begin(handle);
     nhal_result_t result = nhal_i2c_master_write_read_reg(
         handle->ctx,
         handle->device_address,
@@ -77,6 +101,7 @@ eeprom_24c32_result_t eeprom_24c32_read(
         data,
         length
     );
+    trace_end(handle, EEPROM_24C32_TRACE_OP_READ, address, length, result, trace_start);
 
     return hal_to_eeprom_result(result);
 }
@@ -110,12 +135,14 @@ eeprom_24c32_result_t eeprom_24c32_write_page(
     write_buffer[1] = (uint8_t)(address & 0xFF);
     memcpy(&write_buffer[2], data, length);
 
+    uint32_t trace_start = trace_begin(handle);
     nhal_result_t result = nhal_i2c_master_write(
         handle->ctx,
         handle->device_address,
         write_buffer,
         2 + length
     );
+    trace_end(handle, EEPROM_24C32_TRACE_OP_WRITE_PAGE, address, length, result, trace_start);
 
     return hal_to_eeprom_result(result);
 }
@@ -180,12 +207,14 @@ bool eeprom_24c32_is_ready(eeprom_24c32_handle_t *handle)
     }
 
     uint8_t dummy_data = 0;
+    uint32_t trace_start = trace_begin(handle);
     nhal_result_t result = nhal_i2c_master_read(
         handle->ctx,
         handle->device_address,
         &dummy_data,
         1
     );
+    trace_end(handle, EEPROM_24C32_TRACE_OP_READY_PROBE, 0, 1, result, trace_start);
 
     return (result == NHAL_OK);
 }
@@ -0,0 +1,168 @@
+/**
+ * @file eeprom_24c32_params.c
+ * @brief Shadowed parameter region with per-page dirty tracking
+ */
+
+#include "eeprom_24c32_params.h"
+#include <string.h>
+
+static void mark_all_clean(eeprom_24c32_params_t *params)
+{
+    size_t page_count = EEPROM_24C32_PARAMS_PAGE_COUNT(params->size);
+
+    for (size_t page = 0; page < page_count; page++) {
+        params->dirty[page].first = EEPROM_24C32_PAGE_SIZE_BYTES;
+        params->dirty[page].last = 0;
+    }
+}
+
+static void mark_dirty(eeprom_24c32_params_t *params, size_t offset, size_t length)
+{
+    size_t end = offset + length;
+
+    while (offset < end) {
+        size_t page = offset / EEPROM_24C32_PAGE_SIZE_BYTES;
+        size_t page_end = (page + 1) * EEPROM_24C32_PAGE_SIZE_BYTES;
+        size_t span_end = (end < page_end) ? end : page_end;
+        uint8_t first = (uint8_t)(offset % EEPROM_24C32_PAGE_SIZE_BYTES);
+        uint8_t last = (uint8_t)((span_end - 1) % EEPROM_24C32_PAGE_SIZE_BYTES);
+
+        if (first < params->dirty[page].first) {
+            params->dirty[page].first = first;
+        }
+        if (last > params->dirty[page].last) {
+            params->dirty[page].last = last;
+        }
+
+        offset = span_end;
+    }
+}
+
+eeprom_24c32_result_t eeprom_24c32_params_init(
+    eeprom_24c32_params_t *params,
+    eeprom_24c32_handle_t *eeprom,
+    uint16_t base_address,
+    void *shadow,
+    size_t size,
+    eeprom_24c32_params_dirty_t *dirty,
+    size_t dirty_count)
+{
+    if (params == NULL || eeprom == NULL || shadow == NULL || dirty == NULL || size == 0) {
+        return EEPROM_24C32_ERR_INVALID_ARG;
+    }
+
+    if ((base_address & (EEPROM_24C32_PAGE_SIZE_BYTES - 1)) != 0 ||
+        dirty_count < EEPROM_24C32_PARAMS_PAGE_COUNT(size)) {
+        return EEPROM_24C32_ERR_INVALID_ARG;
+    }
+
+    if (base_address >= EEPROM_24C32_SIZE_BYTES ||
+        (base_address + size) > EEPROM_24C32_SIZE_BYTES) {
+        return EEPROM_24C32_ERR_ADDRESS_OUT_OF_RANGE;
+    }
+
+    params->eeprom = eeprom;
+    params->base_address = base_address;
+    params->size = (uint16_t)size;
+    params->shadow = (uint8_t *)shadow;
+    params->dirty = dirty;
+    params->loaded = false;
+    memset(params->shadow, 0, size);
+    mark_all_clean(params);
+
+    return EEPROM_24C32_OK;
+}
+
+eeprom_24c32_result_t eeprom_24c32_params_load(eeprom_24c32_params_t *params)
+{
+    if (params == NULL) {
+        return EEPROM_24C32_ERR_INVALID_ARG;
+    }
+
+    eeprom_24c32_result_t result = eeprom_24c32_read(
+        params->eeprom,
+        params->base_address,
+        params->shadow,
+        params->size
+    );
+
+    mark_all_clean(params);
+    params->loaded = (result == EEPROM_24C32_OK);
+
+    return result;
+}
+
+eeprom_24c32_result_t eeprom_24c32_params_set(
+    eeprom_24c32_params_t *params,
+    size_t offset,
+    const void *data,
+    size_t length)
+{
+    if (params == NULL || data == NULL || length == 0) {
+        return EEPROM_24C32_ERR_INVALID_ARG;
+    }
+
+    if (offset >= params->size || (offset + length) > params->size) {
+        return EEPROM_24C32_ERR_ADDRESS_OUT_OF_RANGE;
+    }
+
+    if (memcmp(&params->shadow[offset], data, length) == 0) {
+        return EEPROM_24C32_OK;
+    }
+
+    memcpy(&params->shadow[offset], data, length);
+    mark_dirty(params, offset, length);
+
+    return EEPROM_24C32_OK;
+}
+
+eeprom_24c32_result_t eeprom_24c32_params_save(eeprom_24c32_params_t *params)
+{
+    if (params == NULL || !params->loaded) {
+        return EEPROM_24C32_ERR_INVALID_ARG;
+    }
+
+    size_t page_count = EEPROM_24C32_PARAMS_PAGE_COUNT(params->size);
+
+    for (size_t page = 0; page < page_count; page++) {
+        eeprom_24c32_params_dirty_t *dirty = &params->dirty[page];
+
+        if (dirty->first > dirty->last) {
+            continue;
+        }
+
+        size_t offset = page * EEPROM_24C32_PAGE_SIZE_BYTES + dirty->first;
+        eeprom_24c32_result_t result = eeprom_24c32_write(
+            params->eeprom,
+            (uint16_t)(params->base_address + offset),
+            &params->shadow[offset],
+            (size_t)(dirty->last - dirty->first) + 1
+        );
+
+        if (result != EEPROM_24C32_OK) {
+            return result;
+        }
+
+        dirty->first = EEPROM_24C32_PAGE_SIZE_BYTES;
+        dirty->last = 0;
+    }
+
+    return EEPROM_24C32_OK;
+}
+
+bool eeprom_24c32_params_is_dirty(const eeprom_24c32_params_t *params)
+{
+    if (params == NULL) {
+        return false;
+    }
+
+    size_t page_count = EEPROM_24C32_PARAMS_PAGE_COUNT(params->size);
+
+    for (size_t page = 0; page < page_count; page++) {
+        if (params->dirty[page].first <= params->dirty[page].last) {
+            return true;
+        }
+    }
+
+    return false;
+}
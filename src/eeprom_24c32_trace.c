@@ -0,0 +1,79 @@
+/**
+ * @file eeprom_24c32_trace.c
+ * @brief Ring-buffer bus-transaction tracer for the 24C32 EEPROM driver
+ */
+
+#include "eeprom_24c32_trace.h"
+
+eeprom_24c32_result_t eeprom_24c32_trace_init(
+    eeprom_24c32_trace_t *trace,
+    eeprom_24c32_trace_record_t *records,
+    size_t capacity,
+    eeprom_24c32_trace_clock_t clock,
+    void *clock_ctx)
+{
+    if (trace == NULL || records == NULL || capacity == 0 || clock == NULL) {
+        return EEPROM_24C32_ERR_INVALID_ARG;
+    }
+
+    trace->records = records;
+    trace->capacity = capacity;
+    trace->clock = clock;
+    trace->clock_ctx = clock_ctx;
+    eeprom_24c32_trace_reset(trace);
+
+    return EEPROM_24C32_OK;
+}
+
+eeprom_24c32_result_t eeprom_24c32_trace_attach(
+    eeprom_24c32_handle_t *handle,
+    eeprom_24c32_trace_t *trace)
+{
+    if (handle == NULL) {
+        return EEPROM_24C32_ERR_INVALID_ARG;
+    }
+
+    handle->trace = trace;
+
+    return EEPROM_24C32_OK;
+}
+
+void eeprom_24c32_trace_reset(eeprom_24c32_trace_t *trace)
+{
+    if (trace == NULL) {
+        return;
+    }
+
+    trace->head = 0;
+    trace->count = 0;
+    trace->dropped = 0;
+}
+
+eeprom_24c32_result_t eeprom_24c32_trace_get(
+    const eeprom_24c32_trace_t *trace,
+    size_t index,
+    eeprom_24c32_trace_record_t *record)
+{
+    if (trace == NULL || record == NULL || index >= trace->count) {
+        return EEPROM_24C32_ERR_INVALID_ARG;
+    }
+
+    size_t oldest = (trace->head + trace->capacity - trace->count) % trace->capacity;
+    *record = trace->records[(oldest + index) % trace->capacity];
+
+    return EEPROM_24C32_OK;
+}
+
+const char *eeprom_24c32_trace_op_name(eeprom_24c32_trace_op_t op)
+{
+    switch (op) {
+        case EEPROM_24C32_TRACE_OP_READ:
+            return "read";
+        case EEPROM_24C32_TRACE_OP_WRITE_PAGE:
+            return "write_page";
+        case EEPROM_24C32_TRACE_OP_READY_PROBE:
+            return "ready_probe";
+        default:
+            return "unknown";
+    }
+}
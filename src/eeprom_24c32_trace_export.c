@@ -0,0 +1,80 @@
+/**
+ * @file eeprom_24c32_trace_export.c
+ * @brief CSV and Chrome trace JSON exporters for recorded bus transactions
+ *
+ * Kept separate from the tracer itself so firmware builds that only record
+ * transactions do not need to link the formatting code.
+ */
+
+#include "eeprom_24c32_trace.h"
+#include <stdio.h>
+#include <string.h>
+
+static void emit(eeprom_24c32_trace_sink_t sink, void *sink_ctx, const char *text)
+{
+    sink(sink_ctx, text, strlen(text));
+}
+
+eeprom_24c32_result_t eeprom_24c32_trace_export_csv(
+    const eeprom_24c32_trace_t *trace,
+    eeprom_24c32_trace_sink_t sink,
+    void *sink_ctx)
+{
+    if (trace == NULL || sink == NULL) {
+        return EEPROM_24C32_ERR_INVALID_ARG;
+    }
+
+    emit(sink, sink_ctx, "timestamp_us,duration_us,op,address,length,result\n");
+
+    for (size_t i = 0; i < trace->count; i++) {
+        eeprom_24c32_trace_record_t record;
+        char line[96];
+
+        eeprom_24c32_trace_get(trace, i, &record);
+        snprintf(line, sizeof(line), "%lu,%lu,%s,%u,%u,%u\n",
+                 (unsigned long)record.timestamp_us,
+                 (unsigned long)record.duration_us,
+                 eeprom_24c32_trace_op_name((eeprom_24c32_trace_op_t)record.op),
+                 (unsigned)record.address,
+                 (unsigned)record.length,
+                 (unsigned)record.result);
+        emit(sink, sink_ctx, line);
+    }
+
+    return EEPROM_24C32_OK;
+}
+
+eeprom_24c32_result_t eeprom_24c32_trace_export_chrome_json(
+    const eeprom_24c32_trace_t *trace,
+    eeprom_24c32_trace_sink_t sink,
+    void *sink_ctx)
+{
+    if (trace == NULL || sink == NULL) {
+        return EEPROM_24C32_ERR_INVALID_ARG;
+    }
+
+    emit(sink, sink_ctx, "{\"traceEvents\":[");
+
+    for (size_t i = 0; i < trace->count; i++) {
+        eeprom_24c32_trace_record_t record;
+        char event[192];
+
+        eeprom_24c32_trace_get(trace, i, &record);
+        snprintf(event, sizeof(event),
+                 "%s\n{\"name\":\"%s\",\"cat\":\"i2c\",\"ph\":\"X\",\"pid\":0,\"tid\":0,"
+                 "\"ts\":%lu,\"dur\":%lu,"
+                 "\"args\":{\"address\":%u,\"length\":%u,\"result\":%u}}",
+                 (i == 0) ? "" : ",",
+                 eeprom_24c32_trace_op_name((eeprom_24c32_trace_op_t)record.op),
+                 (unsigned long)record.timestamp_us,
+                 (unsigned long)record.duration_us,
+                 (unsigned)record.address,
+                 (unsigned)record.length,
+                 (unsigned)record.result);
+        emit(sink, sink_ctx, event);
+    }
+
+    emit(sink, sink_ctx, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    return EEPROM_24C32_OK;
+}
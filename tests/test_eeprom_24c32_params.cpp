@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "test_nhal_i2c_context_stub.h"
+#include "nhal_i2c_mock.hpp"
+
+extern "C" {
+    #include "eeprom_24c32.h"
+    #include "eeprom_24c32_params.h"
+}
+
+using ::testing::_;
+using ::testing::Return;
+using ::testing::Truly;
+
+typedef struct {
+    uint8_t bytes[12];
+} test_calibration_t;
+
+typedef struct {
+    char text[20];
+} test_label_t;
+
+#define TEST_PARAMS(FIELD, FIELD_HOT, set)        \
+    FIELD(set, uint8_t, mode)                     \
+    FIELD_HOT(set, uint32_t, boot_count)          \
+    FIELD_HOT(set, test_calibration_t, calib)     \
+    FIELD(set, uint16_t, flags)                   \
+    FIELD_HOT(set, test_label_t, label)           \
+    FIELD(set, test_label_t, note)
+
+EEPROM_24C32_PARAMS_DECLARE(test_params, TEST_PARAMS)
+
+// Parameter sets must not live on the heap (over-aligned), so the fixture
+// refers to a file-scope instance instead of owning one.
+static test_params_t test_params_storage;
+
+static bool write_starts_at(const uint8_t *buffer, uint16_t address)
+{
+    return buffer[0] == (uint8_t)(address >> 8) && buffer[1] == (uint8_t)(address & 0xFF);
+}
+
+class Eeprom24c32ParamsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        memset(&handle, 0, sizeof(handle));
+        memset(&ctx, 0, sizeof(ctx));
+        memset(&params, 0, sizeof(params));
+
+        ASSERT_EQ(eeprom_24c32_init(&handle, &ctx, 0x50), EEPROM_24C32_OK);
+        ASSERT_EQ(test_params_init(&params, &handle, 0x0100), EEPROM_24C32_OK);
+
+        testing::Mock::VerifyAndClearExpectations(&NhalI2cMock::instance());
+    }
+
+    void TearDown() override {
+        testing::Mock::VerifyAndClearExpectations(&NhalI2cMock::instance());
+    }
+
+    void ExpectLoad(nhal_result_t result) {
+        EXPECT_CALL(NhalI2cMock::instance(),
+                    nhal_i2c_master_write_read_reg(_, _, _, 2, _, sizeof(test_params_image_t)))
+            .WillOnce([result](struct nhal_i2c_context *, nhal_i2c_address, const uint8_t *, size_t,
+                               uint8_t *data, size_t data_len) {
+                memset(data, 0xA5, data_len);
+                return result;
+            });
+    }
+
+    eeprom_24c32_handle_t handle;
+    struct nhal_i2c_context ctx;
+    test_params_t &params = test_params_storage;
+};
+
+TEST_F(Eeprom24c32ParamsTest, LayoutKeepsFieldsWithinPages) {
+    EXPECT_EQ(offsetof(test_params_image_t, mode), 0u);
+    EXPECT_EQ(offsetof(test_params_image_t, boot_count), 4u);
+    EXPECT_EQ(offsetof(test_params_image_t, calib), 16u);
+    EXPECT_EQ(offsetof(test_params_image_t, flags), 28u);
+    EXPECT_EQ(offsetof(test_params_image_t, label), 32u);
+    // Non-hot fields pack tightly and may straddle a page
+    EXPECT_EQ(offsetof(test_params_image_t, note), 52u);
+    EXPECT_EQ(sizeof(params.dirty) / sizeof(params.dirty[0]), 3u);
+}
+
+TEST_F(Eeprom24c32ParamsTest, InitInvalidArgs) {
+    EXPECT_EQ(test_params_init(nullptr, &handle, 0), EEPROM_24C32_ERR_INVALID_ARG);
+    EXPECT_EQ(test_params_init(&params, nullptr, 0), EEPROM_24C32_ERR_INVALID_ARG);
+    EXPECT_EQ(test_params_init(&params, &handle, 0x0101), EEPROM_24C32_ERR_INVALID_ARG);
+    EXPECT_EQ(test_params_init(&params, &handle, EEPROM_24C32_SIZE_BYTES - EEPROM_24C32_PAGE_SIZE_BYTES),
+              EEPROM_24C32_ERR_ADDRESS_OUT_OF_RANGE);
+}
+
+TEST_F(Eeprom24c32ParamsTest, LoadIsSingleSequentialRead) {
+    EXPECT_CALL(NhalI2cMock::instance(), nhal_i2c_master_write_read_reg(
+        &ctx, _,
+        Truly([](const uint8_t *reg) { return reg[0] == 0x01 && reg[1] == 0x00; }),
+        2, _, sizeof(test_params_image_t)))
+        .WillOnce([](struct nhal_i2c_context *, nhal_i2c_address, const uint8_t *, size_t,
+                     uint8_t *data, size_t data_len) {
+            memset(data, 0, data_len);
+            data[offsetof(test_params_image_t, boot_count)] = 0x2A;
+            return NHAL_OK;
+        });
+
+    ASSERT_EQ(test_params_set_mode(&params, 3), EEPROM_24C32_OK);
+    ASSERT_EQ(test_params_load(&params), EEPROM_24C32_OK);
+
+    EXPECT_EQ(test_params_get_mode(&params), 0);
+    EXPECT_EQ(test_params_get_boot_count(&params) & 0xFF, 0x2Au);
+    EXPECT_FALSE(eeprom_24c32_params_is_dirty(&params.region));
+}
+
+TEST_F(Eeprom24c32ParamsTest, SetUnchangedValueStaysClean) {
+    ASSERT_EQ(test_params_set_flags(&params, 0), EEPROM_24C32_OK);
+    EXPECT_FALSE(eeprom_24c32_params_is_dirty(&params.region));
+
+    ASSERT_EQ(test_params_set_flags(&params, 0x1234), EEPROM_24C32_OK);
+    EXPECT_TRUE(eeprom_24c32_params_is_dirty(&params.region));
+    EXPECT_EQ(test_params_get_flags(&params), 0x1234);
+}
+
+TEST_F(Eeprom24c32ParamsTest, SaveWritesOnePagePerDirtyPage) {
+    test_label_t label = {"sensor-7"};
+
+    ExpectLoad(NHAL_OK);
+    ASSERT_EQ(test_params_load(&params), EEPROM_24C32_OK);
+
+    test_params_set_mode(&params, 1);
+    test_params_set_flags(&params, 0xBEEF);
+    test_params_set_label(&params, label);
+
+    {
+        ::testing::InSequence seq;
+
+        // Page 0: span from mode (offset 0) to the end of flags (offset 29);
+        // the untouched fields in between carry the loaded bytes
+        EXPECT_CALL(NhalI2cMock::instance(), nhal_i2c_master_write(
+            _, _, Truly([](const uint8_t *buf) {
+                return write_starts_at(buf, 0x0100) && buf[2] == 1 &&
+                       buf[2 + offsetof(test_params_image_t, boot_count)] == 0xA5 &&
+                       buf[2 + offsetof(test_params_image_t, calib)] == 0xA5;
+            }), 2 + 30))
+            .WillOnce(Return(NHAL_OK));
+        EXPECT_CALL(NhalI2cMock::instance(), nhal_i2c_master_read(_, _, _, 1))
+            .WillOnce(Return(NHAL_OK));
+
+        // Page 1: label only
+        EXPECT_CALL(NhalI2cMock::instance(), nhal_i2c_master_write(
+            _, _, Truly([](const uint8_t *buf) {
+                return write_starts_at(buf, 0x0120) && memcmp(&buf[2], "sensor-7", 8) == 0;
+            }), 2 + sizeof(test_label_t)))
+            .WillOnce(Return(NHAL_OK));
+        EXPECT_CALL(NhalI2cMock::instance(), nhal_i2c_master_read(_, _, _, 1))
+            .WillOnce(Return(NHAL_OK));
+    }
+
+    EXPECT_EQ(test_params_save(&params), EEPROM_24C32_OK);
+    EXPECT_FALSE(eeprom_24c32_params_is_dirty(&params.region));
+}
+
+TEST_F(Eeprom24c32ParamsTest, SaveWithoutChangesIssuesNoTransactions) {
+    ExpectLoad(NHAL_OK);
+    ASSERT_EQ(test_params_load(&params), EEPROM_24C32_OK);
+
+    EXPECT_CALL(NhalI2cMock::instance(), nhal_i2c_master_write(_, _, _, _)).Times(0);
+
+    EXPECT_EQ(test_params_save(&params), EEPROM_24C32_OK);
+}
+
+TEST_F(Eeprom24c32ParamsTest, SaveWithoutLoadIsRefused) {
+    test_params_set_mode(&params, 1);
+    test_params_set_flags(&params, 0xBEEF);
+
+    EXPECT_CALL(NhalI2cMock::instance(), nhal_i2c_master_write(_, _, _, _)).Times(0);
+
+    EXPECT_EQ(test_params_save(&params), EEPROM_24C32_ERR_INVALID_ARG);
+    EXPECT_TRUE(eeprom_24c32_params_is_dirty(&params.region));
+}
+
+TEST_F(Eeprom24c32ParamsTest, FailedLoadDiscardsChangesAndBlocksSave) {
+    ExpectLoad(NHAL_OK);
+    ASSERT_EQ(test_params_load(&params), EEPROM_24C32_OK);
+
+    test_params_set_mode(&params, 1);
+    ExpectLoad(NHAL_ERR_NO_RESPONSE);
+    EXPECT_EQ(test_params_load(&params), EEPROM_24C32_ERR_I2C_ERROR);
+    EXPECT_FALSE(eeprom_24c32_params_is_dirty(&params.region));
+
+    test_params_set_flags(&params, 0xBEEF);
+    EXPECT_CALL(NhalI2cMock::instance(), nhal_i2c_master_write(_, _, _, _)).Times(0);
+
+    EXPECT_EQ(test_params_save(&params), EEPROM_24C32_ERR_INVALID_ARG);
+}
+
+TEST_F(Eeprom24c32ParamsTest, FailedSaveKeepsPageDirty) {
+    ExpectLoad(NHAL_OK);
+    ASSERT_EQ(test_params_load(&params), EEPROM_24C32_OK);
+
+    test_params_set_boot_count(&params, 7);
+
+    EXPECT_CALL(NhalI2cMock::instance(), nhal_i2c_master_write(_, _, _, 2 + 4))
+        .WillOnce(Return(NHAL_ERR_NO_RESPONSE));
+
+    EXPECT_EQ(test_params_save(&params), EEPROM_24C32_ERR_I2C_ERROR);
+    EXPECT_TRUE(eeprom_24c32_params_is_dirty(&params.region));
+}
+
+TEST_F(Eeprom24c32ParamsTest, SetOutOfRange) {
+    uint8_t value = 0;
+
+    EXPECT_EQ(eeprom_24c32_params_set(&params.region, sizeof(test_params_image_t), &value, 1),
+              EEPROM_24C32_ERR_ADDRESS_OUT_OF_RANGE);
+    EXPECT_EQ(eeprom_24c32_params_set(&params.region, 0, nullptr, 1),
+              EEPROM_24C32_ERR_INVALID_ARG);
+}
@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <string>
+#include "test_nhal_i2c_context_stub.h"
+#include "nhal_i2c_mock.hpp"
+
+extern "C" {
+    #include "eeprom_24c32.h"
+    #include "eeprom_24c32_trace.h"
+}
+
+using ::testing::_;
+using ::testing::Return;
+using ::testing::HasSubstr;
+
+static uint32_t fake_clock(void *clock_ctx)
+{
+    uint32_t *now = static_cast<uint32_t *>(clock_ctx);
+    uint32_t value = *now;
+    *now += 10;
+    return value;
+}
+
+static void string_sink(void *sink_ctx, const char *text, size_t length)
+{
+    static_cast<std::string *>(sink_ctx)->append(text, length);
+}
+
+class Eeprom24c32TraceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        memset(&handle, 0, sizeof(handle));
+        memset(&ctx, 0, sizeof(ctx));
+        now_us = 1000;
+
+        ASSERT_EQ(eeprom_24c32_init(&handle, &ctx, 0x50), EEPROM_24C32_OK);
+        ASSERT_EQ(eeprom_24c32_trace_init(&trace, records, 4, fake_clock, &now_us),
+                  EEPROM_24C32_OK);
+        ASSERT_EQ(eeprom_24c32_trace_attach(&handle, &trace), EEPROM_24C32_OK);
+
+        testing::Mock::VerifyAndClearExpectations(&NhalI2cMock::instance());
+    }
+
+    void TearDown() override {
+        testing::Mock::VerifyAndClearExpectations(&NhalI2cMock::instance());
+    }
+
+    eeprom_24c32_handle_t handle;
+    struct nhal_i2c_context ctx;
+    eeprom_24c32_trace_t trace;
+    eeprom_24c32_trace_record_t records[4];
+    uint32_t now_us;
+};
+
+TEST_F(Eeprom24c32TraceTest, InitInvalidArgs) {
+    EXPECT_EQ(eeprom_24c32_trace_init(nullptr, records, 4, fake_clock, nullptr),
+              EEPROM_24C32_ERR_INVALID_ARG);
+    EXPECT_EQ(eeprom_24c32_trace_init(&trace, nullptr, 4, fake_clock, nullptr),
+              EEPROM_24C32_ERR_INVALID_ARG);
+    EXPECT_EQ(eeprom_24c32_trace_init(&trace, records, 0, fake_clock, nullptr),
+              EEPROM_24C32_ERR_INVALID_ARG);
+    EXPECT_EQ(eeprom_24c32_trace_init(&trace, records, 4, nullptr, nullptr),
+              EEPROM_24C32_ERR_INVALID_ARG);
+    EXPECT_EQ(eeprom_24c32_trace_attach(nullptr, &trace), EEPROM_24C32_ERR_INVALID_ARG);
+}
+
+TEST_F(Eeprom24c32TraceTest, InitLeavesTracingDisabled) {
+    eeprom_24c32_handle_t fresh;
+    memset(&fresh, 0xFF, sizeof(fresh));
+
+    ASSERT_EQ(eeprom_24c32_init(&fresh, &ctx, 0x50), EEPROM_24C32_OK);
+
+    EXPECT_EQ(fresh.trace, nullptr);
+}
+
+TEST_F(Eeprom24c32TraceTest, RecordsRead) {
+    uint8_t buffer[8];
+
+    EXPECT_CALL(NhalI2cMock::instance(), nhal_i2c_master_write_read_reg(_, _, _, 2, buffer, 8))
+        .WillOnce(Return(NHAL_OK));
+
+    EXPECT_EQ(eeprom_24c32_read(&handle, 0x0123, buffer, 8), EEPROM_24C32_OK);
+
+    eeprom_24c32_trace_record_t record;
+    ASSERT_EQ(trace.count, 1u);
+    ASSERT_EQ(eeprom_24c32_trace_get(&trace, 0, &record), EEPROM_24C32_OK);
+    EXPECT_EQ(record.op, EEPROM_24C32_TRACE_OP_READ);
+    EXPECT_EQ(record.address, 0x0123);
+    EXPECT_EQ(record.length, 8);
+    EXPECT_EQ(record.result, NHAL_OK);
+    EXPECT_EQ(record.timestamp_us, 1000u);
+    EXPECT_EQ(record.duration_us, 10u);
+}
+
+TEST_F(Eeprom24c32TraceTest, RecordsWriteAndFailedProbes) {
+    uint8_t data[4] = {0x01, 0x02, 0x03, 0x04};
+
+    EXPECT_CALL(NhalI2cMock::instance(), nhal_i2c_master_write(_, _, _, 6))
+        .WillOnce(Return(NHAL_OK));
+    EXPECT_CALL(NhalI2cMock::instance(), nhal_i2c_master_read(_, _, _, 1))
+        .WillOnce(Return(NHAL_ERR_NO_RESPONSE))
+        .WillOnce(Return(NHAL_OK));
+
+    EXPECT_EQ(eeprom_24c32_write(&handle, 0x0040, data, 4), EEPROM_24C32_OK);
+
+    eeprom_24c32_trace_record_t record;
+    ASSERT_EQ(trace.count, 3u);
+
+    eeprom_24c32_trace_get(&trace, 0, &record);
+    EXPECT_EQ(record.op, EEPROM_24C32_TRACE_OP_WRITE_PAGE);
+    EXPECT_EQ(record.address, 0x0040);
+    EXPECT_EQ(record.length, 4);
+
+    eeprom_24c32_trace_get(&trace, 1, &record);
+    EXPECT_EQ(record.op, EEPROM_24C32_TRACE_OP_READY_PROBE);
+    EXPECT_EQ(record.result, NHAL_ERR_NO_RESPONSE);
+
+    eeprom_24c32_trace_get(&trace, 2, &record);
+    EXPECT_EQ(record.op, EEPROM_24C32_TRACE_OP_READY_PROBE);
+    EXPECT_EQ(record.result, NHAL_OK);
+}
+
+TEST_F(Eeprom24c32TraceTest, RingBufferOverwritesOldest) {
+    EXPECT_CALL(NhalI2cMock::instance(), nhal_i2c_master_read(_, _, _, 1))
+        .Times(6)
+        .WillRepeatedly(Return(NHAL_OK));
+
+    for (int i = 0; i < 6; i++) {
+        eeprom_24c32_is_ready(&handle);
+    }
+
+    eeprom_24c32_trace_record_t record;
+    EXPECT_EQ(trace.count, 4u);
+    EXPECT_EQ(trace.dropped, 2u);
+
+    // Each probe consumes two clock ticks, so the oldest surviving record is the third probe
+    ASSERT_EQ(eeprom_24c32_trace_get(&trace, 0, &record), EEPROM_24C32_OK);
+    EXPECT_EQ(record.timestamp_us, 1040u);
+    ASSERT_EQ(eeprom_24c32_trace_get(&trace, 3, &record), EEPROM_24C32_OK);
+    EXPECT_EQ(record.timestamp_us, 1100u);
+    EXPECT_EQ(eeprom_24c32_trace_get(&trace, 4, &record), EEPROM_24C32_ERR_INVALID_ARG);
+
+    eeprom_24c32_trace_reset(&trace);
+    EXPECT_EQ(trace.count, 0u);
+    EXPECT_EQ(trace.dropped, 0u);
+}
+
+TEST_F(Eeprom24c32TraceTest, DetachedTracerRecordsNothing) {
+    ASSERT_EQ(eeprom_24c32_trace_attach(&handle, nullptr), EEPROM_24C32_OK);
+
+    EXPECT_CALL(NhalI2cMock::instance(), nhal_i2c_master_read(_, _, _, 1))
+        .WillOnce(Return(NHAL_OK));
+
+    eeprom_24c32_is_ready(&handle);
+
+    EXPECT_EQ(trace.count, 0u);
+    EXPECT_EQ(now_us, 1000u);
+}
+
+TEST_F(Eeprom24c32TraceTest, ExportCsv) {
+    uint8_t buffer[2];
+
+    EXPECT_CALL(NhalI2cMock::instance(), nhal_i2c_master_write_read_reg(_, _, _, _, _, _))
+        .WillOnce(Return(NHAL_ERR_TIMEOUT));
+
+    eeprom_24c32_read(&handle, 0x0010, buffer, 2);
+
+    std::string out;
+    ASSERT_EQ(eeprom_24c32_trace_export_csv(&trace, string_sink, &out), EEPROM_24C32_OK);
+
+    std::string expected = "timestamp_us,duration_us,op,address,length,result\n"
+                           "1000,10,read,16,2," + std::to_string(NHAL_ERR_TIMEOUT) + "\n";
+    EXPECT_EQ(out, expected);
+}
+
+TEST_F(Eeprom24c32TraceTest, ExportChromeJson) {
+    EXPECT_CALL(NhalI2cMock::instance(), nhal_i2c_master_read(_, _, _, 1))
+        .Times(2)
+        .WillRepeatedly(Return(NHAL_OK));
+
+    eeprom_24c32_is_ready(&handle);
+    eeprom_24c32_is_ready(&handle);
+
+    std::string out;
+    ASSERT_EQ(eeprom_24c32_trace_export_chrome_json(&trace, string_sink, &out), EEPROM_24C32_OK);
+
+    EXPECT_EQ(out.rfind("{\"traceEvents\":[", 0), 0u);
+    EXPECT_THAT(out, HasSubstr("\"name\":\"ready_probe\""));
+    EXPECT_THAT(out, HasSubstr("\"ph\":\"X\""));
+    EXPECT_THAT(out, HasSubstr("\"ts\":1000,\"dur\":10"));
+    EXPECT_THAT(out, HasSubstr("},\n{"));
+    EXPECT_THAT(out, HasSubstr("\n]"));
+}
+
+TEST_F(Eeprom24c32TraceTest, ExportInvalidArgs) {
+    std::string out;
+
+    EXPECT_EQ(eeprom_24c32_trace_export_csv(nullptr, string_sink, &out),
+              EEPROM_24C32_ERR_INVALID_ARG);
+    EXPECT_EQ(eeprom_24c32_trace_export_csv(&trace, nullptr, &out),
+              EEPROM_24C32_ERR_INVALID_ARG);
+    EXPECT_EQ(eeprom_24c32_trace_export_chrome_json(nullptr, string_sink, &out),
+              EEPROM_24C32_ERR_INVALID_ARG);
+    EXPECT_EQ(eeprom_24c32_trace_export_chrome_json(&trace, nullptr, &out),
+              EEPROM_24C32_ERR_INVALID_ARG);
+}